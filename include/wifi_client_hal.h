@@ -334,6 +334,123 @@ typedef INT (*wifi_connectEndpoint_callback)(INT ssidIndex, CHAR *AP_SSID, wifiS
  */
 void wifi_connectEndpoint_callback_register(wifi_connectEndpoint_callback callback_proc);
 
+/**
+ * @struct _wifi_eventInfo
+ * @brief Structure for event dispatch information
+ *
+ * Describes the delivery of an event by the HAL event dispatcher.
+ */
+typedef struct _wifi_eventInfo
+{
+    ULLONG sequence;           /**< Sequence number of the event. Incremented by one for every state event, starting at 1 after wifi_init(). Scan result events of wifi_scanResult_callback() are not numbered */
+    ULLONG enqueue_time_us;    /**< Time at which the driver event was queued, in microseconds of CLOCK_MONOTONIC */
+    ULLONG dispatch_time_us;   /**< Time at which the callback was invoked, in microseconds of CLOCK_MONOTONIC */
+} wifi_eventInfo_t;
+
+/**
+ * @brief Receives status updates from HAL in case of a disconnection event, with event dispatch information
+ *
+ * Same as wifi_disconnectEndpoint_callback(), with the dispatch information of the event.
+ *
+ * @param[in]  ssidIndex The index of SSID array
+ * @param[in]  AP_SSID   The ssid to disconnect
+ * @param[out] error     An enum variable that indicates the Wi-Fi connection status, as in wifi_disconnectEndpoint_callback()
+ * @param[in]  eventInfo Sequence number and timestamps of the event. Only valid for the duration of the callback.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_disconnectEndpointEx_callback_register() should be called before calling this API
+ * @see wifi_disconnectEndpoint_callback(), wifi_eventInfo_t
+ */
+typedef INT (*wifi_disconnectEndpointEx_callback)(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error, const wifi_eventInfo_t *eventInfo);
+
+/**
+ * @brief Registers for disconnect callback with event dispatch information
+ *
+ * If both this callback and the one registered with #wifi_disconnectEndpoint_callback_register() are set, only this callback is invoked.
+ *
+ * @param[in] callback_proc the callback function to disconnect the client
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_disconnectEndpoint_callback_register()
+ */
+void wifi_disconnectEndpointEx_callback_register(wifi_disconnectEndpointEx_callback callback_proc);
+
+/**
+ * @brief Receives status updates from HAL in case of a connection event, with event dispatch information
+ *
+ * Same as wifi_connectEndpoint_callback(), with the dispatch information of the event.
+ *
+ * @param[in]  ssidIndex The index of SSID array
+ * @param[in]  AP_SSID   The ssid to connect
+ * @param[out] error     An enum variable that indicates the Wi-Fi connection status, as in wifi_connectEndpoint_callback()
+ * @param[in]  eventInfo Sequence number and timestamps of the event. Only valid for the duration of the callback.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_connectEndpointEx_callback_register() should be called before calling this API
+ * @see wifi_connectEndpoint_callback(), wifi_eventInfo_t
+ */
+typedef INT (*wifi_connectEndpointEx_callback)(INT ssidIndex, CHAR *AP_SSID, wifiStatusCode_t *error, const wifi_eventInfo_t *eventInfo);
+
+/**
+ * @brief Registers for connect callback with event dispatch information
+ *
+ * If both this callback and the one registered with #wifi_connectEndpoint_callback_register() are set, only this callback is invoked.
+ *
+ * @param[in] callback_proc The callback function to connect the client to the access point
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_connectEndpoint_callback_register()
+ */
+void wifi_connectEndpointEx_callback_register(wifi_connectEndpointEx_callback callback_proc);
+
+/**
+ * @brief Defines for the minimum number of events each HAL event queue holds
+ */
+#define WIFI_HAL_EVENT_QUEUE_MIN_CAPACITY 64
+
+/**
+ * @struct _wifi_eventDispatchStats
+ * @brief Structure for event dispatcher statistics
+ *
+ * State events (scan complete, connect, disconnect, init stage and the other callbacks) are never dropped: when their
+ * queue is full, it is grown. Scan result events of wifi_scanResult_callback() have their own queue, which drops new events when full.
+ */
+typedef struct _wifi_eventDispatchStats
+{
+    ULLONG events_enqueued;           /**< Number of state events queued since wifi_init() */
+    ULLONG events_dispatched;         /**< Number of state events delivered to a callback since wifi_init() */
+    UINT   queue_capacity;            /**< Number of state events the queue currently holds. Range is [WIFI_HAL_EVENT_QUEUE_MIN_CAPACITY, 2^32 - 1] */
+    UINT   queue_depth;               /**< Number of state events currently queued. Range is [0, queue_capacity] */
+    UINT   queue_high_watermark;      /**< Largest queue_depth observed since wifi_init(). Range is [0, queue_capacity] */
+    ULLONG max_dispatch_latency_us;   /**< Largest difference between dispatch_time_us and enqueue_time_us observed since wifi_init() */
+    ULLONG last_sequence;             /**< Sequence number of the last state event queued */
+    ULLONG results_enqueued;          /**< Number of scan result events queued since wifi_init() */
+    ULLONG results_dropped;           /**< Number of scan result events dropped because the scan result queue was full since wifi_init() */
+    UINT   result_queue_capacity;     /**< Number of scan result events the scan result queue holds. Range is [WIFI_HAL_EVENT_QUEUE_MIN_CAPACITY, 2^32 - 1] */
+    UINT   result_queue_depth;        /**< Number of scan result events currently queued. Range is [0, result_queue_capacity] */
+} wifi_eventDispatchStats_t;
+
+/**
+ * @brief Gets the statistics of the HAL event dispatcher
+ *
+ * @param[out] stats Structure which holds the event dispatcher statistics
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_eventDispatchStats_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getEventDispatchStats(wifi_eventDispatchStats_t *stats);
+
 /**
  * @brief Registers for Telemetry callback
  * 
@@ -341,10 +458,129 @@ void wifi_connectEndpoint_callback_register(wifi_connectEndpoint_callback callba
  * 
  * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
  * @see wifi_telemetry_ops_t, wifi_telemetry_ops_t.init(), wifi_telemetry_ops_t.event_s(), wifi_telemetry_ops_t.event_d()
- * @note is depreciated and will be removed in coming releases.
+ * @note is depreciated and will be removed in coming releases. Use wifi_getHalMetrics() and wifi_getApiMetrics() instead.
  */
 void wifi_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops);
 
+/**
+ * @brief Defines for the number of buckets in a latency histogram
+ *
+ * Bucket 0 counts latencies below 2us, bucket i counts latencies in [2^i, 2^(i+1)) us
+ * and the last bucket counts latencies of 2^(WIFI_HAL_LATENCY_HISTOGRAM_BUCKETS - 1) us and above.
+ */
+#define WIFI_HAL_LATENCY_HISTOGRAM_BUCKETS 24
+
+/**
+ * @struct _wifi_apiMetrics
+ * @brief Structure for the metrics of a single API
+ */
+typedef struct _wifi_apiMetrics
+{
+    CHAR   api_name[64];                                            /**< Name of the API {Ex: "wifi_getStats"} */
+    ULLONG call_count;                                              /**< Number of calls */
+    ULLONG error_count;                                             /**< Number of calls that did not return #RETURN_OK */
+    ULLONG driver_round_trips;                                      /**< Number of requests sent to the driver or supplicant on behalf of the calls */
+    ULLONG total_latency_us;                                        /**< Sum of the call latencies in microseconds */
+    ULLONG max_latency_us;                                          /**< Largest call latency in microseconds */
+    ULLONG latency_histogram[WIFI_HAL_LATENCY_HISTOGRAM_BUCKETS];   /**< Number of calls per latency bucket */
+} wifi_apiMetrics_t;
+
+/**
+ * @struct _wifi_connectTiming
+ * @brief Structure for the phase timings of a connection attempt
+ *
+ * Phases that were not reached are reported as 0.
+ */
+typedef struct _wifi_connectTiming
+{
+    ULLONG           start_time_us;       /**< Time at which the connection attempt started, in microseconds of CLOCK_MONOTONIC */
+    ULLONG           scan_us;             /**< Time spent scanning for the access point, in microseconds */
+    ULLONG           authentication_us;   /**< Time spent in 802.11 authentication, including SAE, in microseconds */
+    ULLONG           association_us;      /**< Time spent in 802.11 association, in microseconds */
+    ULLONG           key_exchange_us;     /**< Time spent in the EAP exchange and 4-way handshake, in microseconds */
+    ULLONG           directed_us;         /**< Time spent on the single-channel directed association of wifi_fastReconnectEndpoint(), in microseconds */
+    ULLONG           total_us;            /**< Time from the start of the attempt to its outcome, in microseconds */
+    BOOL             fast_reconnect;      /**< Set if the attempt was started by wifi_fastReconnectEndpoint() {0-false, 1-true} */
+    BOOL             fallback_scan;       /**< Set if the directed association failed or was skipped and a full scan was performed {0-false, 1-true} */
+    wifiStatusCode_t status;              /**< Outcome of the attempt, as reported by wifi_connectEndpoint_callback() or wifi_disconnectEndpoint_callback() */
+} wifi_connectTiming_t;
+
+/**
+ * @struct _wifi_halMetrics
+ * @brief Structure for HAL-wide metrics
+ */
+typedef struct _wifi_halMetrics
+{
+    ULLONG scan_requests;                                                /**< Number of scans requested by callers through any scan API */
+    ULLONG scans_coalesced;                                              /**< Number of scan requests attached to a compatible scan already in progress instead of starting a new scan */
+    ULLONG scans_started;                                                /**< Number of scans requested from the driver */
+    ULLONG scans_completed;                                              /**< Number of scans that completed before the timeout */
+    ULLONG scans_timed_out;                                              /**< Number of scans that reached the timeout */
+    ULLONG scan_duration_histogram[WIFI_HAL_LATENCY_HISTOGRAM_BUCKETS];  /**< Number of scans per duration bucket */
+    UINT   callback_queue_depth;                                         /**< Number of state events currently queued for dispatch, as reported in queue_depth of wifi_eventDispatchStats_t */
+    UINT   callback_queue_high_watermark;                                /**< Largest number of state events queued for dispatch, as reported in queue_high_watermark of wifi_eventDispatchStats_t */
+    UINT   result_queue_depth;                                           /**< Number of scan result events currently queued for dispatch, as reported in result_queue_depth of wifi_eventDispatchStats_t */
+    ULLONG results_dropped;                                              /**< Number of scan result events dropped because the scan result queue was full, as reported in results_dropped of wifi_eventDispatchStats_t */
+    ULLONG control_requests;                                             /**< Number of requests sent on the driver control channel */
+    UINT   control_max_in_flight;                                        /**< Largest number of requests pending a response on the driver control channel at the same time */
+    ULLONG control_reconnects;                                           /**< Number of times the driver control channel or event channel had to be re-opened */
+    ULLONG unsolicited_events;                                           /**< Number of unsolicited events received on the driver event channel */
+    ULLONG connect_attempts;                                             /**< Number of connection attempts */
+    ULLONG connect_failures;                                             /**< Number of connection attempts that did not reach WIFI_HAL_SUCCESS */
+    wifi_connectTiming_t last_connect;                                   /**< Phase timings of the last completed connection attempt */
+} wifi_halMetrics_t;
+
+/**
+ * @brief Gets the HAL-wide metrics
+ *
+ * Metrics are accumulated since wifi_init() or the last wifi_resetHalMetrics().
+ *
+ * @param[out] metrics Structure which holds the HAL-wide metrics
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_halMetrics_t, wifi_getApiMetrics(), wifi_resetHalMetrics()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getHalMetrics(wifi_halMetrics_t *metrics);
+
+/**
+ * @brief Gets the per-API metrics
+ *
+ * One entry is reported for each API that has been called at least once since wifi_init() or the last wifi_resetHalMetrics().
+ * When metrics_array is too small, the remaining entries are left out and counted in truncated_count, so that the caller
+ * can retry with an array of output_array_size + truncated_count entries.
+ *
+ * @param[out] metrics_array     Array of per-API metrics. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity     Number of entries metrics_array can hold
+ * @param[out] output_array_size Number of entries written to metrics_array. Range is [0, array_capacity]
+ * @param[out] truncated_count   Number of entries left out because metrics_array was too small
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK   - if successful, including when entries were left out
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_apiMetrics_t, wifi_getHalMetrics()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getApiMetrics(wifi_apiMetrics_t *metrics_array, UINT array_capacity, UINT *output_array_size, UINT *truncated_count);
+
+/**
+ * @brief Resets the HAL-wide and per-API metrics
+ *
+ * @returns INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_getHalMetrics(), wifi_getApiMetrics()
+ */
+INT wifi_resetHalMetrics(void);
+
 /**
  * @brief Provides the last connected SSID information
  *
@@ -359,6 +595,48 @@ void wifi_telemetry_callback_register(wifi_telemetry_ops_t *telemetry_ops);
  */
 INT wifi_lastConnected_Endpoint(wifi_pairedSSIDInfo_t *pairedSSIDInfo);
 
+/**
+ * @brief Provides the BSSID and operating frequency of the last connection
+ *
+ * The BSSID and frequency are persisted together with the SSID information returned by #wifi_lastConnected_Endpoint(),
+ * whose ap_bssid is not required to be filled.
+ *
+ * @param[out] bssid     BSSID of the last connection, in "AA:BB:CC:DD:EE:FF" format. Empty string if unknown. Memory of at least 18 bytes must be pre-allocated by the caller.
+ * @param[out] frequency Operating frequency of the last connection in MHz. Possible values are those of sta_Frequency in wifi_sta_stats_t. 0 if unknown.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_lastConnected_Endpoint(), wifi_fastReconnectEndpoint()
+ */
+INT wifi_getLastConnectedBSS(CHAR *bssid, UINT *frequency);
+
+/**
+ * @brief Starts a fast reconnection to the last connected access point
+ *
+ * Attempts a directed association to bssid on the given frequency only, without a full scan.
+ * If that attempt fails, falls back to a full scan and connects as #wifi_connectEndpoint() does.
+ * If bssid is NULL or empty, or frequency is 0, the directed association is skipped and the full scan is performed straight away.
+ * The duration of each phase is reported in the last_connect field of wifi_halMetrics_t.
+ *
+ * @param[in] ssidIndex      The index of SSID array {Valid values: 1}
+ * @param[in] pairedSSIDInfo SSID information, as returned by #wifi_lastConnected_Endpoint()
+ * @param[in] bssid          BSSID of the access point, in "AA:BB:CC:DD:EE:FF" format, as returned by #wifi_getLastConnectedBSS()
+ * @param[in] frequency      Operating frequency of the access point in MHz, as returned by #wifi_getLastConnectedBSS()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @pre wifi_connectEndpoint_callback_register() should be called before calling this API
+ * @see wifi_pairedSSIDInfo_t, wifi_getLastConnectedBSS(), wifi_connectEndpoint(), wifi_connectEndpoint_callback(), wifi_connectTiming_t
+ * @note On successfull connect, wifi_connectEndpoint_callback() will be called
+ */
+INT wifi_fastReconnectEndpoint(INT ssidIndex, wifi_pairedSSIDInfo_t *pairedSSIDInfo, const CHAR *bssid, UINT frequency);
+
 /**
  * @brief Sets the roaming control parameters
  *
@@ -389,6 +667,173 @@ INT wifi_setRoamingControl(int ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data)
  */
 INT wifi_getRoamingControl(int ssidIndex, wifi_roamingCtrl_t *pRoamingCtrl_data);
 
+/**
+ * @struct _wifi_bgScanConfig
+ * @brief Structure for background scan scheduler configuration
+ *
+ * The link is degraded when sta_RSSI of wifi_sta_stats_t is below postAssnSelfSteerThreshold of wifi_roamingCtrl_t,
+ * or when sta_Retransmissions is above retransThreshold. Otherwise the link is good.
+ */
+typedef struct _wifi_bgScanConfig
+{
+    BOOL enable;               /**< Enables or disables background scanning {0-disable, 1-enable} */
+    UINT minInterval;          /**< Interval between scans while the link is degraded or disconnected. Default value 10. Range is [1, 3600] seconds */
+    UINT maxInterval;          /**< Largest interval between scans while the link is good. Default value 300. Range is [minInterval, 3600] seconds */
+    UINT retransThreshold;     /**< sta_Retransmissions above which the link is degraded. Default value 10. Range is [0, 100] */
+    BOOL knownChannelsOnly;    /**< Scans only the channels of the last connected network while the link is good, with a full scan every maxInterval {0-disable, 1-enable} */
+} wifi_bgScanConfig_t;
+
+/**
+ * @brief Enumerators for the link state seen by the background scan scheduler
+ */
+typedef enum {
+    WIFI_HAL_BGSCAN_LINK_GOOD = 0,     /**< Link is good, the interval doubles after every scan up to maxInterval */
+    WIFI_HAL_BGSCAN_LINK_DEGRADED,     /**< Link is degraded, scans every minInterval */
+    WIFI_HAL_BGSCAN_LINK_DISCONNECTED  /**< Not connected, scans every minInterval */
+} wifi_bgScanLinkState_t;
+
+/**
+ * @struct _wifi_bgScanStatus
+ * @brief Structure for background scan scheduler status
+ */
+typedef struct _wifi_bgScanStatus
+{
+    wifi_bgScanLinkState_t linkState;       /**< Current link state */
+    UINT                   currentInterval; /**< Current interval between scans in seconds. Range is [minInterval, maxInterval] */
+    ULLONG                 nextScanTime_ms; /**< Time of the next scan, in milliseconds of CLOCK_MONOTONIC. 0 if background scanning is disabled */
+    ULLONG                 scansPerformed;  /**< Number of background scans performed since wifi_init() */
+    UINT                   lastGeneration;  /**< Scan cache generation produced by the last background scan, as reported in wifi_scanCacheInfo_t */
+} wifi_bgScanStatus_t;
+
+/**
+ * @brief Sets the background scan scheduler configuration
+ *
+ * The scheduler scans in the background while background scanning is enabled, and adapts its interval to the link state.
+ * While the link is good, the interval doubles after every scan up to maxInterval. As soon as the link is degraded or
+ * lost, the interval drops to minInterval. Background scan results update the scan cache.
+ * The scheduler is paused by wifi_standby() and restarted with the same configuration by wifi_resume().
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[in] config     Structure with background scan scheduler configuration
+ *
+ * @returns INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected or if config is out of range
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_bgScanConfig_t, wifi_roamingCtrl_t, wifi_getBackgroundScanConfig(), wifi_getBackgroundScanStatus()
+ */
+INT wifi_setBackgroundScanConfig(INT radioIndex, const wifi_bgScanConfig_t *config);
+
+/**
+ * @brief Gets the background scan scheduler configuration
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[out] config    Structure with background scan scheduler configuration
+ *
+ * @returns INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_bgScanConfig_t, wifi_setBackgroundScanConfig()
+ */
+INT wifi_getBackgroundScanConfig(INT radioIndex, wifi_bgScanConfig_t *config);
+
+/**
+ * @brief Gets the background scan scheduler status
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[out] status    Structure with background scan scheduler status
+ *
+ * @returns INT - The status of the operation
+ * @retval #RETURN_OK   - if successful
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_bgScanStatus_t, wifi_setBackgroundScanConfig()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getBackgroundScanStatus(INT radioIndex, wifi_bgScanStatus_t *status);
+
+/**
+ * @struct _wifi_roamCandidate
+ * @brief Structure for a roaming candidate
+ *
+ * Candidates are the access points of the cached scan results that advertise the connected SSID and security mode.
+ * score is rssi plus bandBonus, where bandBonus is preassnBestDelta of wifi_roamingCtrl_t for 5GHz access points and 0 otherwise.
+ */
+typedef struct _wifi_roamCandidate
+{
+    CHAR               bssid[64];   /**< BSSID of the candidate. MAC will be of "AA:BB:CC:DD:EE:FF" format */
+    UINT               channel;     /**< Channel of the candidate. Possible values {1-13, 36-64,100-165} */
+    WIFI_HAL_FREQ_BAND band;        /**< Frequency band of the candidate */
+    INT                rssi;        /**< Signal strength of the candidate in dBm. Range is [-200, 0] */
+    INT                bandBonus;   /**< Band preference added to rssi. Range is [0, 100] */
+    INT                score;       /**< rssi plus bandBonus */
+    BOOL               current;     /**< Set for the access point the client is connected to {0-false, 1-true} */
+    BOOL               eligible;    /**< Set if the score exceeds the score of the current access point by at least postAssnLevelDeltaConnected {0-false, 1-true} */
+} wifi_roamCandidate_t;
+
+/**
+ * @brief Enumerators for roaming decisions
+ */
+typedef enum {
+    WIFI_HAL_ROAM_DECISION_NONE = 0,   /**< No decision, roaming is disabled or the client is not connected */
+    WIFI_HAL_ROAM_DECISION_STAY,       /**< Current RSSI is above postAssnSelfSteerThreshold, or no candidate is eligible */
+    WIFI_HAL_ROAM_DECISION_ROAM,       /**< Roaming to the best eligible candidate */
+    WIFI_HAL_ROAM_DECISION_BACKOFF     /**< A previous roaming attempt failed and the current self steer timeframe has not elapsed since */
+} wifi_roamDecision_t;
+
+/**
+ * @struct _wifi_roamDecisionTrace
+ * @brief Structure for the trace of the last roaming decision
+ */
+typedef struct _wifi_roamDecisionTrace
+{
+    wifi_roamDecision_t decision;           /**< The decision taken */
+    ULLONG              timestamp_ms;       /**< Time of the decision, in milliseconds of CLOCK_MONOTONIC */
+    UINT                scanGeneration;     /**< Generation of the cached scan results the candidates were taken from */
+    INT                 currentRssi;        /**< RSSI of the current access point in dBm, from wifi_sta_stats_t */
+    INT                 currentScore;       /**< Score of the current access point */
+    INT                 threshold;          /**< postAssnSelfSteerThreshold applied */
+    INT                 hysteresis;         /**< postAssnLevelDeltaConnected applied */
+    CHAR                targetBssid[64];    /**< BSSID of the best eligible candidate. Empty string if there is none */
+    INT                 targetScore;        /**< Score of the best eligible candidate */
+    UINT                selfSteerTimeframe; /**< Current self steer timeframe in seconds: postAssnSelfSteerTimeframe plus postAssnBackOffTime for every consecutive failed roaming attempt */
+    UINT                failedAttempts;     /**< Number of consecutive failed roaming attempts since the last association */
+    UINT                backoffRemaining;   /**< Seconds until roaming is attempted again if decision is WIFI_HAL_ROAM_DECISION_BACKOFF, that is until selfSteerTimeframe has elapsed since the last failed attempt */
+} wifi_roamDecisionTrace_t;
+
+/**
+ * @brief Gets the ranked roaming candidates and the trace of the last roaming decision
+ *
+ * The HAL roaming engine re-evaluates the candidates whenever the current RSSI crosses postAssnSelfSteerThreshold and
+ * whenever the cached scan results change, so that a roam does not wait for a new full scan. It roams when roamingEnable
+ * and selfSteerOverride of wifi_roamingCtrl_t are set, the current RSSI is below postAssnSelfSteerThreshold and a candidate
+ * is eligible.
+ *
+ * Roaming attempts are spaced by the self steer timeframe. It starts at postAssnSelfSteerTimeframe and, after each failed
+ * roaming attempt, is incremented by postAssnBackOffTime; no roam is attempted until the current timeframe has elapsed since
+ * the last failed attempt. The timeframe is reset to postAssnSelfSteerTimeframe on every new association, including a successful roam.
+ *
+ * @param[in] ssidIndex          The index of the SSID {Valid values: 1}
+ * @param[out] candidates        Array of candidates ordered by decreasing score, including the current access point. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity     Number of entries candidates can hold
+ * @param[out] output_array_size Number of entries written to candidates. Range is [0, array_capacity]
+ * @param[out] truncated_count   Number of lowest-scoring candidates left out because candidates was too small
+ * @param[out] trace             Trace of the last roaming decision. May be NULL.
+ *
+ * @returns INT - The status of the operation
+ * @retval #RETURN_OK   - if successful, including when candidates were left out
+ * @retval #RETURN_ERR  - if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_roamCandidate_t, wifi_roamDecisionTrace_t, wifi_roamingCtrl_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getRoamCandidates(INT ssidIndex, wifi_roamCandidate_t *candidates, UINT array_capacity, UINT *output_array_size, UINT *truncated_count, wifi_roamDecisionTrace_t *trace);
+
 /**
  * @brief Cancels any in-progress WPS operation
  *
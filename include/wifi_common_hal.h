@@ -115,6 +115,10 @@
 #define ULONG unsigned long
 #endif
 
+#ifndef ULLONG
+#define ULLONG unsigned long long /**< unsigned long long */
+#endif
+
 #ifndef BOOL
 #define BOOL  unsigned char /**< unsigned char bool */
 #endif
@@ -131,6 +135,14 @@
 #define INT   int /**< int */
 #endif
 
+#ifndef SHORT
+#define SHORT  short /**< short */
+#endif
+
+#ifndef USHORT
+#define USHORT unsigned short /**< unsigned short */
+#endif
+
 #ifndef UINT
 #define UINT  unsigned int /**< insigned int */
 #endif
@@ -177,10 +189,10 @@
 #endif 
 
 /**
- * @brief Defines for HAL version 2.0.0
+ * @brief Defines for HAL version 2.1.0
  */
 #define WIFI_HAL_MAJOR_VERSION 2         /**<  This is the major version of this HAL */
-#define WIFI_HAL_MINOR_VERSION 0         /**<  This is the minor version of the HAL */
+#define WIFI_HAL_MINOR_VERSION 1         /**<  This is the minor version of the HAL */
 #define WIFI_HAL_MAINTENANCE_VERSION 0   /**<  This is the maintenance version of the HAL */
 
 /**
@@ -217,6 +229,7 @@ typedef enum {
     WIFI_HAL_SUCCESS = 0,                    /**< Successful connect/disconnect */
     WIFI_HAL_CONNECTING,                     /**< Attempting to connect to a Network/AP using wps or SSID selection */
     WIFI_HAL_DISCONNECTING = 10,             /**< Attempting to disconnect to a Network/AP */
+    WIFI_HAL_SCAN_STOPPED_EARLY,             /**< A streaming scan was stopped by its stop filter before covering every channel */
 
     /* Failure/Error Codes */
     WIFI_HAL_ERROR_NOT_FOUND = 20,           /**< Device/AP not found */
@@ -229,6 +242,7 @@ typedef enum {
     WIFI_HAL_ERROR_INVALID_CREDENTIALS,      /**< The connection failed due to invalid credentials */
     WIFI_HAL_UNRECOVERABLE_ERROR,            /**< The device has encountered an unrecoverable (driver or hardware failures) errors */
     WIFI_HAL_ERROR_AUTH_FAILED,              /**< The connection failed due to authentication failure */
+    WIFI_HAL_ERROR_CANCELLED,                /**< The operation was cancelled by the caller */
     WIFI_HAL_ERROR_UNKNOWN = 40              /**< Unknown/unspecified error */
 } wifiStatusCode_t;
 
@@ -352,6 +366,104 @@ typedef struct _wifi_neighbor_ap
 
 } wifi_neighbor_ap_t;
 
+/**
+ * @brief Bitmask of security modes advertised by an access point
+ *
+ * The legacy ap_SecurityModeEnabled strings map as {"None": 0, "WPA-WPA2": WPA | WPA2, "WPA2-Enterprise": WPA2 | ENTERPRISE, ...}
+ */
+#define WIFI_HAL_SECURITY_FLAG_WEP         (1U << 0) /**< WEP */
+#define WIFI_HAL_SECURITY_FLAG_WPA         (1U << 1) /**< WPA */
+#define WIFI_HAL_SECURITY_FLAG_WPA2        (1U << 2) /**< WPA2 */
+#define WIFI_HAL_SECURITY_FLAG_WPA3        (1U << 3) /**< WPA3 */
+#define WIFI_HAL_SECURITY_FLAG_ENTERPRISE  (1U << 4) /**< Enterprise (802.1X) authentication */
+
+/**
+ * @brief Bitmask of encryption modes advertised by an access point
+ */
+#define WIFI_HAL_ENCRYPTION_FLAG_TKIP      (1U << 0) /**< TKIP */
+#define WIFI_HAL_ENCRYPTION_FLAG_AES       (1U << 1) /**< AES */
+
+/**
+ * @brief Bitmask of IEEE 802.11 standards
+ */
+#define WIFI_HAL_STANDARD_FLAG_A           (1U << 0) /**< 802.11a */
+#define WIFI_HAL_STANDARD_FLAG_B           (1U << 1) /**< 802.11b */
+#define WIFI_HAL_STANDARD_FLAG_G           (1U << 2) /**< 802.11g */
+#define WIFI_HAL_STANDARD_FLAG_N           (1U << 3) /**< 802.11n */
+#define WIFI_HAL_STANDARD_FLAG_AC          (1U << 4) /**< 802.11ac */
+#define WIFI_HAL_STANDARD_FLAG_AX          (1U << 5) /**< 802.11ax */
+
+/**
+ * @brief Enumerators for WiFi channel bandwidths
+ */
+typedef enum {
+    WIFI_HAL_CHANNEL_BANDWIDTH_AUTO = 0,   /**< "Auto" */
+    WIFI_HAL_CHANNEL_BANDWIDTH_20MHZ,      /**< "20MHz" */
+    WIFI_HAL_CHANNEL_BANDWIDTH_40MHZ,      /**< "40MHz" */
+    WIFI_HAL_CHANNEL_BANDWIDTH_80MHZ,      /**< "80MHz" */
+    WIFI_HAL_CHANNEL_BANDWIDTH_160MHZ      /**< "160MHz" */
+} wifi_channelBandwidth_t;
+
+/**
+ * @brief Enumerators for WiFi access point modes
+ */
+typedef enum {
+    WIFI_HAL_AP_MODE_INFRASTRUCTURE = 0,   /**< "Infrastructure" */
+    WIFI_HAL_AP_MODE_ADHOC                 /**< "AdHoc" */
+} wifi_apMode_t;
+
+/**
+ * @brief Defines for the maximum number of data transfer rates in wifi_compact_neighbor_ap_t
+ */
+#define WIFI_HAL_MAX_DATA_TRANSFER_RATES 16
+
+/**
+ * @struct _wifi_compact_neighbor_ap
+ * @brief structure for compact neighbor_ap
+ *
+ * Compact form of wifi_neighbor_ap_t. String fields are replaced by enums and bitmasks, rate lists by numeric arrays,
+ * and the SSID by an offset into the SSID pool of the enclosing wifi_compactScanResult_t.
+ */
+typedef struct _wifi_compact_neighbor_ap
+{
+    UCHAR  ap_BSSID[6];                                              /**< The BSSID used for the neighboring WiFi SSID in binary form */
+    USHORT ap_SSIDOffset;                                            /**< Offset of the NUL-terminated SSID in ssid_pool of wifi_compactScanResult_t. Identical SSIDs share the same offset */
+    UCHAR  ap_Channel;                                               /**< The current radio channel used by the neighboring WiFi radio. Possible values {1-13, 36-64,100-165} */
+    UCHAR  ap_OperatingFrequencyBand;                                /**< Frequency band of the neighboring WiFi radio, one of WIFI_HAL_FREQ_BAND */
+    UCHAR  ap_Mode;                                                  /**< Mode of the neighboring WiFi radio, one of wifi_apMode_t */
+    UCHAR  ap_OperatingChannelBandwidth;                             /**< Bandwidth of the operating channel, one of wifi_channelBandwidth_t */
+    SHORT  ap_SignalStrength;                                        /**< RSSI of the neighboring WiFi radio in dBm. Range is [-200, 0] */
+    SHORT  ap_Noise;                                                 /**< Average noise strength received from the neighboring WiFi radio in dBm. Range is [-200, 0] */
+    UCHAR  ap_SecurityModeEnabled;                                   /**< Bitmask of WIFI_HAL_SECURITY_FLAG_* values. 0 means "None" */
+    UCHAR  ap_EncryptionMode;                                        /**< Bitmask of WIFI_HAL_ENCRYPTION_FLAG_* values */
+    UCHAR  ap_SupportedStandards;                                    /**< Bitmask of WIFI_HAL_STANDARD_FLAG_* values */
+    UCHAR  ap_OperatingStandards;                                    /**< Bitmask of WIFI_HAL_STANDARD_FLAG_* values. Each bit MUST also be set in ap_SupportedStandards */
+    USHORT ap_BeaconPeriod;                                          /**< Time interval (in ms) between transmitting beacons. Range is [0, 2^16 - 1] */
+    UCHAR  ap_DTIMPeriod;                                            /**< The number of beacon intervals between DTIM beacons. Range is [0, 255] */
+    UCHAR  ap_ChannelUtilization;                                    /**< Fraction of the time the channel is in use by the neighboring AP, in percent. Range is [0, 100] */
+    UCHAR  ap_NumBasicDataTransferRates;                             /**< Number of valid entries in ap_BasicDataTransferRates. Range is [0, WIFI_HAL_MAX_DATA_TRANSFER_RATES] */
+    UCHAR  ap_NumSupportedDataTransferRates;                         /**< Number of valid entries in ap_SupportedDataTransferRates. Range is [0, WIFI_HAL_MAX_DATA_TRANSFER_RATES] */
+    USHORT ap_BasicDataTransferRates[WIFI_HAL_MAX_DATA_TRANSFER_RATES];     /**< Basic data transmit rates in units of 500 kbps {Ex: 11 for 5.5 Mbps}. Range is [2, 19216] */
+    USHORT ap_SupportedDataTransferRates[WIFI_HAL_MAX_DATA_TRANSFER_RATES]; /**< Supported data transmit rates in units of 500 kbps {Ex: 11 for 5.5 Mbps}. Range is [2, 19216] */
+
+} wifi_compact_neighbor_ap_t;
+
+/**
+ * @struct _wifi_compactScanResult
+ * @brief structure for compact scan results
+ *
+ * The structure, ap_array and ssid_pool are laid out in a single contiguous block of memory.
+ */
+typedef struct _wifi_compactScanResult
+{
+    UINT   generation;                         /**< Generation number of the scan results, as reported in wifi_scanCacheInfo_t */
+    ULLONG timestamp_ms;                       /**< Time at which the scan completed, in milliseconds of CLOCK_MONOTONIC */
+    UINT   ap_count;                           /**< Number of entries in ap_array, maximum limit is 512 */
+    UINT   ssid_pool_size;                     /**< Size of ssid_pool in bytes */
+    wifi_compact_neighbor_ap_t *ap_array;      /**< Array of neighboring access points */
+    CHAR   *ssid_pool;                         /**< Unique SSIDs of the scan results, each NUL-terminated, referenced by ap_SSIDOffset */
+} wifi_compactScanResult_t;
+
 /**
  * @struct _wifi_sta_stats
  * @brief structure for Access Point info
@@ -405,11 +517,15 @@ INT wifi_getHalVersion(CHAR *output_string);
  * - Open communication channels for monitoring and control interfaces
  * - Create the wpa_supplicant event monitoring thread.
  *
+ * These steps run as the concurrent stages described in wifi_initStage_t, and this function returns once they are started.
+ * An API called before the stage it depends on has completed waits for that stage.
+ * The radio capabilities returned by #wifi_getRadioCapabilities() are probed on first use.
+ *
  * @return #INT - The status of the operation
  * @retval #RETURN_OK  if successful
  * @retval #RETURN_ERR if any error is detected
  *
- * @see wifi_uninit()
+ * @see wifi_uninit(), wifi_initStage_t, wifi_initStage_callback_register()
  * @note This function must not invoke any blocking calls.
  */
 INT wifi_init(); 
@@ -429,6 +545,80 @@ INT wifi_init();
  */
 INT wifi_initWithConfig(wifi_halConfig_t *conf);
 
+/**
+ * @brief Enumerators for the stages of wifi_init() and wifi_initWithConfig()
+ *
+ * WIFI_HAL_INIT_STAGE_CONFIG_LOAD and WIFI_HAL_INIT_STAGE_INTERFACE_UP run concurrently.
+ * WIFI_HAL_INIT_STAGE_SUPPLICANT_ATTACH starts when WIFI_HAL_INIT_STAGE_INTERFACE_UP completes.
+ * WIFI_HAL_INIT_STAGE_CAPABILITY_PROBE is deferred until the first API that needs the radio capabilities is called.
+ *
+ * A stage which fails after wifi_init() or wifi_initWithConfig() has returned is reported through wifi_initStage_callback()
+ * and #wifi_getInitStageTiming() with #RETURN_ERR. The stages depending on it are not started and are reported as failed as well.
+ * An API waiting on a failed stage, or called after it failed, returns #RETURN_ERR without accessing the driver.
+ * A failed WIFI_HAL_INIT_STAGE_CAPABILITY_PROBE is retried by #wifi_refreshRadioCapabilities(); any other failed stage
+ * requires #wifi_uninit() followed by a new initialization.
+ */
+typedef enum {
+    WIFI_HAL_INIT_STAGE_CONFIG_LOAD = 0,       /**< Persisted configuration loaded. wifi_lastConnected_Endpoint() and wifi_getLastConnectedBSS() are served from here */
+    WIFI_HAL_INIT_STAGE_INTERFACE_UP,          /**< Wireless interface brought up */
+    WIFI_HAL_INIT_STAGE_SUPPLICANT_ATTACH,     /**< Supplicant / driver control and event channels open */
+    WIFI_HAL_INIT_STAGE_CAPABILITY_PROBE,      /**< Radio capabilities probed, see wifi_getRadioCapabilities() */
+    WIFI_HAL_INIT_STAGE_MAX
+} wifi_initStage_t;
+
+/**
+ * @struct _wifi_initStageTiming
+ * @brief structure for initStageTiming
+ */
+typedef struct _wifi_initStageTiming
+{
+    ULLONG start_time_us;   /**< Time at which the stage started, in microseconds of CLOCK_MONOTONIC. 0 if the stage has not started */
+    ULLONG end_time_us;     /**< Time at which the stage completed, in microseconds of CLOCK_MONOTONIC. 0 if the stage has not completed */
+    INT    status;          /**< #RETURN_OK if the stage completed successfully, #RETURN_ERR otherwise */
+} wifi_initStageTiming_t;
+
+/**
+ * @brief Receives a notification when a stage of wifi_init() or wifi_initWithConfig() completes
+ *
+ * @param[in] stage  The stage that completed
+ * @param[in] status #RETURN_OK if the stage completed successfully, #RETURN_ERR otherwise
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_initStage_callback_register() should be called before calling this API
+ * @see wifi_initStage_t
+ */
+typedef INT (*wifi_initStage_callback)(wifi_initStage_t stage, INT status);
+
+/**
+ * @brief Registers for init stage callback
+ *
+ * Unlike other APIs, this function may be called before wifi_init() or wifi_initWithConfig(), so that no stage notification is missed.
+ *
+ * @param[in] callback_proc The callback function to receive init stage notifications
+ *
+ * @see wifi_init(), wifi_initWithConfig()
+ */
+void wifi_initStage_callback_register(wifi_initStage_callback callback_proc);
+
+/**
+ * @brief Gets the timing of the stages of the last wifi_init() or wifi_initWithConfig()
+ *
+ * @param[out] timing_array Array of stage timings indexed by wifi_initStage_t. To be allocated and de-allocated by the caller.
+ * @param[in] array_size    Number of entries timing_array can hold. WIFI_HAL_INIT_STAGE_MAX is always sufficient.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_initStageTiming_t, wifi_initStage_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getInitStageTiming(wifi_initStageTiming_t *timing_array, UINT array_size);
+
 /**
  * @brief Disables all WiFi interfaces
  *
@@ -449,6 +639,9 @@ INT wifi_down();
  * - Stop wpa_supplicant daemon.
  * - Close communication channels for monitoring and control interfaces
  * - Shut down any threads that were created during #wifi_init() #wifi_initWithConfig
+ *
+ * Stages of wifi_init() or wifi_initWithConfig() still running are cancelled, and this function waits for them to stop.
+ * APIs waiting on a cancelled stage return #RETURN_ERR. No wifi_initStage_callback() is invoked once this function has returned.
  * 
  * @return #INT - The status of the operation
  * @retval #RETURN_OK  if successful
@@ -459,6 +652,49 @@ INT wifi_down();
  */
 INT wifi_uninit();
 
+/**
+ * @brief Puts the WiFi module in warm standby
+ *
+ * Intended as a lightweight alternative to #wifi_uninit() when WiFi is shut down because ethernet is plugged in.
+ * For instance, steps involved in a wifi_standby operation for a wpa_supplicant-based WiFi-HAL:
+ * - Disconnect and leave the radio idle
+ * - Shut down HAL threads, such as the statistics sampler, background scanning and the event dispatcher
+ * - Release the scan result cache and other large buffers
+ * - Keep the supplicant running with its control and event channels open, and keep the radio capabilities and persisted configuration loaded
+ *
+ * No callbacks are invoked while in standby. Only wifi_standby(), #wifi_resume() and #wifi_uninit() may be called while in standby.
+ * Calling wifi_standby() while in standby has no effect.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful or if already in standby
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_resume(), wifi_uninit()
+ * @note This call will block until the disconnection has completed and the HAL threads have been joined.
+ */
+INT wifi_standby(void);
+
+/**
+ * @brief Resumes the WiFi module from warm standby
+ *
+ * Restarts the HAL threads released by #wifi_standby(), discards the driver events received while in standby
+ * and restores the state that wifi_init() or wifi_initWithConfig() would have established, without restarting the supplicant
+ * or probing the radio capabilities again.
+ * The statistics sampler and the background scanner are restarted with the configuration they had before #wifi_standby().
+ * The sampler history and the scan result cache restart empty. The epoch and generation of the scan result cache are kept:
+ * emptying the cache increments the generation, so that generations are never reused within an epoch.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if not in standby
+ *
+ * @pre wifi_standby() should be called before calling this API
+ * @see wifi_standby()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_resume(void);
+
 /**
  * @brief Gets current station connection status bssid,ssid,rssi,phyrate,noise,band
  *
@@ -574,6 +810,28 @@ INT wifi_getRadioMaxBitRate(INT radioIndex, CHAR *output_string);
  */
 INT wifi_getRadioSupportedFrequencyBands(INT radioIndex, CHAR *output_string);
 
+/**
+ * @brief Defines the bit of a WIFI_HAL_FREQ_BAND in a frequency band bitmask
+ */
+#define WIFI_HAL_FREQ_BAND_FLAG(band) (1U << (band))
+
+/**
+ * @brief Gets the supported frequency bands as a bitmask
+ *
+ * Typed variant of #wifi_getRadioSupportedFrequencyBands().
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[out] bands      Bitmask of WIFI_HAL_FREQ_BAND_FLAG() values {Ex: WIFI_HAL_FREQ_BAND_FLAG(WIFI_HAL_FREQ_BAND_24GHZ) | WIFI_HAL_FREQ_BAND_FLAG(WIFI_HAL_FREQ_BAND_5GHZ)}
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see WIFI_HAL_FREQ_BAND, wifi_getRadioSupportedFrequencyBands()
+ */
+INT wifi_getRadioSupportedFrequencyBandsMask(INT radioIndex, UINT *bands);
+
 /**
  * @brief Gets the frequency band at which the radio is operating
  * 
@@ -610,6 +868,23 @@ INT wifi_getRadioOperatingFrequencyBand(INT radioIndex, CHAR *output_string);
  */
 INT wifi_getRadioSupportedStandards(INT radioIndex, CHAR *output_string);
 
+/**
+ * @brief Gets radio supported standards as a bitmask
+ *
+ * Typed variant of #wifi_getRadioSupportedStandards().
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[out] standards  Bitmask of WIFI_HAL_STANDARD_FLAG_* values {Ex: WIFI_HAL_STANDARD_FLAG_A | WIFI_HAL_STANDARD_FLAG_N | WIFI_HAL_STANDARD_FLAG_AC}
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_getRadioSupportedStandards()
+ */
+INT wifi_getRadioSupportedStandardsMask(INT radioIndex, UINT *standards);
+
 /**
  * @brief Gets the radio operating mode and pure mode flag
  * 
@@ -651,6 +926,41 @@ INT wifi_getRadioStandard(INT radioIndex, CHAR *output_string, BOOL *gOnly, BOOL
  */
 INT wifi_getRadioPossibleChannels(INT radioIndex, CHAR *output_string);
 
+/**
+ * @struct _wifi_channelBitmap
+ * @brief structure for channelBitmap
+ *
+ * Bit (channel % 32) of bitmap[channel / 32] is set when the channel is in the set.
+ * 2.4GHz and 5GHz channel numbers do not overlap, so one bitmap holds both bands.
+ */
+typedef struct _wifi_channelBitmap
+{
+    UINT bitmap[8];   /**< Channels 0 to 255 */
+} wifi_channelBitmap_t;
+
+/**
+ * @brief Checks whether a channel is set in a wifi_channelBitmap_t
+ */
+#define WIFI_HAL_CHANNEL_ISSET(channels, channel) \
+    (((channels)->bitmap[((channel) & 0xFFU) / 32] >> ((channel) % 32)) & 1U)
+
+/**
+ * @brief Gets the supported channels as a bitmap
+ *
+ * Typed variant of #wifi_getRadioPossibleChannels().
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[out] channels   Bitmap of the supported channels
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_channelBitmap_t, WIFI_HAL_CHANNEL_ISSET, wifi_getRadioPossibleChannels()
+ */
+INT wifi_getRadioPossibleChannelsBitmap(INT radioIndex, wifi_channelBitmap_t *channels);
+
 /**
  * @brief Gets the list of channels currently in use
  *
@@ -668,6 +978,23 @@ INT wifi_getRadioPossibleChannels(INT radioIndex, CHAR *output_string);
  */
 INT wifi_getRadioChannelsInUse(INT radioIndex, CHAR *output_string);
 
+/**
+ * @brief Gets the channels currently in use as a bitmap
+ *
+ * Typed variant of #wifi_getRadioChannelsInUse().
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[out] channels   Bitmap of the channels in use
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_channelBitmap_t, WIFI_HAL_CHANNEL_ISSET, wifi_getRadioChannelsInUse()
+ */
+INT wifi_getRadioChannelsInUseBitmap(INT radioIndex, wifi_channelBitmap_t *channels);
+
 /**
  * @brief Gets the current radio channel used by the connection
  *
@@ -815,6 +1142,30 @@ INT wifi_getRadioMCS(INT radioIndex, INT *output_INT);
  */
 INT wifi_getRadioTransmitPowerSupported(INT radioIndex, CHAR *output_list);
 
+/**
+ * @brief Defines for the maximum number of supported transmit power levels
+ */
+#define WIFI_HAL_MAX_TRANSMIT_POWER_LEVELS 16
+
+/**
+ * @brief Gets the supported transmit power levels as an array
+ *
+ * Typed variant of #wifi_getRadioTransmitPowerSupported().
+ *
+ * @param[in] radioIndex         The index of the radio {Valid values: 1}
+ * @param[out] power_list        Array of supported transmit power levels as percentage of full power. A -1 item indicates auto mode. Range is [-1, 100]
+ * @param[in] list_capacity      Number of entries power_list can hold. WIFI_HAL_MAX_TRANSMIT_POWER_LEVELS is always sufficient.
+ * @param[out] output_list_size  Number of entries written to power_list. Range is [0, list_capacity]
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if list_capacity is too small
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_getRadioTransmitPowerSupported()
+ */
+INT wifi_getRadioTransmitPowerSupportedList(INT radioIndex, INT *power_list, UINT list_capacity, UINT *output_list_size);
+
 /**
  * @brief Gets the current transmit Power
  *
@@ -881,6 +1232,66 @@ INT wifi_getRadioIEEE80211hEnabled(INT radioIndex, BOOL *enable);
  */
 INT wifi_getRegulatoryDomain(INT radioIndex, CHAR *output_string);
 
+/**
+ * @struct _wifi_radioCapabilities
+ * @brief structure for radioCapabilities
+ *
+ * Radio properties that do not change at runtime, probed once from the driver.
+ */
+typedef struct _wifi_radioCapabilities
+{
+    UINT                 generation;                                                   /**< Incremented by one every time the capabilities are probed. Range is [1, 2^32 - 1] */
+    ULLONG               probe_time_us;                                                /**< Time at which the capabilities were probed, in microseconds of CLOCK_MONOTONIC */
+    UINT                 supported_frequency_bands;                                    /**< Bitmask of WIFI_HAL_FREQ_BAND_FLAG() values, as returned by wifi_getRadioSupportedFrequencyBandsMask() */
+    UINT                 supported_standards;                                          /**< Bitmask of WIFI_HAL_STANDARD_FLAG_* values, as returned by wifi_getRadioSupportedStandardsMask() */
+    wifi_channelBitmap_t possible_channels;                                            /**< Supported channels, as returned by wifi_getRadioPossibleChannelsBitmap() */
+    FLOAT                max_bit_rate_mbps;                                            /**< Maximum PHY bit rate in Mbps, as returned by wifi_getRadioMaxBitRate(). Range is [0, 2.4 * 1024] */
+    INT                  transmit_power_supported[WIFI_HAL_MAX_TRANSMIT_POWER_LEVELS]; /**< Supported transmit power levels, as returned by wifi_getRadioTransmitPowerSupportedList() */
+    UINT                 num_transmit_power_supported;                                 /**< Number of valid entries in transmit_power_supported. Range is [0, WIFI_HAL_MAX_TRANSMIT_POWER_LEVELS] */
+    BOOL                 ieee80211h_supported;                                         /**< 802.11h support, as returned by wifi_getRadioIEEE80211hSupported() {0-Not supported, 1-supported} */
+    BOOL                 auto_channel_supported;                                       /**< Auto channel selection support, as returned by wifi_getRadioAutoChannelSupported() {0-Not supported, 1-supported} */
+    BOOL                 dual_band_supported;                                          /**< Dual band support, as returned by wifi_getDualBandSupport() {0-Not supported, 1-supported} */
+    BOOL                 concurrent_band_scan_supported;                               /**< Set if the hardware can scan both frequency bands at the same time {0-Not supported, 1-supported} */
+} wifi_radioCapabilities_t;
+
+/**
+ * @brief Gets the static capabilities of the radio
+ *
+ * The capabilities are probed from the driver once after wifi_init() or wifi_initWithConfig(), when first needed, and are only probed again
+ * by #wifi_refreshRadioCapabilities(). The getters of the individual properties listed in wifi_radioCapabilities_t
+ * return the same values without accessing the driver.
+ *
+ * @param[in] radioIndex     The index of the radio {Valid values: 1}
+ * @param[out] capabilities  Structure which holds the radio capabilities
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_radioCapabilities_t, wifi_refreshRadioCapabilities()
+ * @note The first call after wifi_init() or wifi_initWithConfig() blocks until WIFI_HAL_INIT_STAGE_SUPPLICANT_ATTACH
+ *       and WIFI_HAL_INIT_STAGE_CAPABILITY_PROBE have completed. Later calls must not invoke any blocking calls.
+ */
+INT wifi_getRadioCapabilities(INT radioIndex, wifi_radioCapabilities_t *capabilities);
+
+/**
+ * @brief Probes the static capabilities of the radio from the driver again
+ *
+ * Replaces the capabilities returned by #wifi_getRadioCapabilities() and increments their generation,
+ * {Ex: after a driver or firmware reload}.
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_getRadioCapabilities()
+ */
+INT wifi_refreshRadioCapabilities(INT radioIndex);
+
 /**
  * @brief Gets detailed radio traffic statistics information
  *
@@ -962,67 +1373,295 @@ INT wifi_getSSIDMACAddress(INT ssidIndex, CHAR *output_string);
 INT wifi_getSSIDTrafficStats(INT ssidIndex, wifi_ssidTrafficStats_t *output_struct);
 
 /**
- * @brief Starts a WiFi scan and gets the scan results
- * 
- * Starts a scan and, after the scan completes or a timeout of 4s occurs, collects scan results.
+ * @brief Defines for the fields of wifi_statsSnapshot_t
+ */
+#define WIFI_HAL_STATS_FIELD_STA_STATS       (1U << 0) /**< sta_stats, as returned by wifi_getStats() */
+#define WIFI_HAL_STATS_FIELD_RADIO_STATS     (1U << 1) /**< radio_stats, as returned by wifi_getRadioTrafficStats() */
+#define WIFI_HAL_STATS_FIELD_SSID_STATS      (1U << 2) /**< ssid_stats, as returned by wifi_getSSIDTrafficStats() */
+#define WIFI_HAL_STATS_FIELD_CHANNEL         (1U << 3) /**< channel, as returned by wifi_getRadioChannel() */
+#define WIFI_HAL_STATS_FIELD_BANDWIDTH       (1U << 4) /**< channel_bandwidth, as returned by wifi_getRadioOperatingChannelBandwidth() */
+#define WIFI_HAL_STATS_FIELD_TRANSMIT_POWER  (1U << 5) /**< transmit_power, as returned by wifi_getRadioTransmitPower() */
+#define WIFI_HAL_STATS_FIELD_MCS             (1U << 6) /**< mcs, as returned by wifi_getRadioMCS() */
+#define WIFI_HAL_STATS_FIELD_ALL             (0x7FU)   /**< All of the above */
+
+/**
+ * @struct _wifi_statsSnapshot
+ * @brief structure for statsSnapshot
  *
- * @param[in] radioIndex          The index of the radio {Valid values: 1}
- * @param[out] neighbor_ap_array  Array of neighboring access points found by the WiFi scan. To be allocated by this function and de-allocated by the caller.
- * @param[out] output_array_size  Size of neighbor_ap_array, maximum limit is 512.
+ * Link, radio and SSID statistics collected at the same point in time.
+ */
+typedef struct _wifi_statsSnapshot
+{
+    ULLONG                   timestamp_us;        /**< Time at which the statistics were collected, in microseconds of CLOCK_MONOTONIC */
+    UINT                     fields_present;      /**< Bitmask of WIFI_HAL_STATS_FIELD_* values of the fields that are valid */
+    wifi_sta_stats_t         sta_stats;           /**< Station connection status */
+    wifi_radioTrafficStats_t radio_stats;         /**< Radio traffic statistics */
+    wifi_ssidTrafficStats_t  ssid_stats;          /**< SSID traffic statistics */
+    ULONG                    channel;             /**< Current radio channel. Possible values {1-13, 36-64,100-165} */
+    wifi_channelBandwidth_t  channel_bandwidth;   /**< Operating channel bandwidth */
+    INT                      transmit_power;      /**< Current transmit power. A value of -1 indicates auto mode. Range is [-1, 100] */
+    INT                      mcs;                 /**< Modulation Coding Scheme index. Possible values {802.11n - "0-31", 802.11ac - "0-9", 802.11ax - "1-11"} */
+} wifi_statsSnapshot_t;
+
+/**
+ * @brief Gets link, radio and SSID statistics in one call
+ *
+ * Collects the requested statistics from the driver in a single transaction, so that all counters
+ * refer to the same point in time. Fields that are requested but not available from the driver are left out of fields_present.
+ *
+ * @param[in] radioIndex       The index of the radio {Valid values: 1}
+ * @param[in] ssidIndex        The index of the SSID {Valid values: 1}
+ * @param[in] fields_requested Bitmask of WIFI_HAL_STATS_FIELD_* values to collect
+ * @param[out] snapshot        Structure which holds the collected statistics
  *
  * @return #INT - The status of the operation
  * @retval #RETURN_OK  if successful
  * @retval #RETURN_ERR if any error is detected
  *
- * @see wifi_neighbor_ap_t
  * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
- * @see @ref Data-Model Parameter: Device.WiFi.NeighboringWiFiDiagnostic., Device.WiFi.NeighboringWiFiDiagnostic.Result
- * @note This call will block until scan completes or a timeout occurs, whichever is earlier
+ * @see wifi_statsSnapshot_t, wifi_getStats(), wifi_getRadioTrafficStats(), wifi_getSSIDTrafficStats()
  */
-INT wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+INT wifi_getStatsSnapshot(INT radioIndex, INT ssidIndex, UINT fields_requested, wifi_statsSnapshot_t *snapshot);
 
 /**
- * @brief Starts a WiFi scan and gets the scan results that match the given SSID name and frequency band
+ * @brief Defines for the maximum number of samples kept by the statistics sampler for each subscription
+ */
+#define WIFI_HAL_STATS_HISTORY_MAX_SAMPLES 300
+
+/**
+ * @struct _wifi_statsSamplerConfig
+ * @brief structure for statsSamplerConfig
+ */
+typedef struct _wifi_statsSamplerConfig
+{
+    UINT interval_ms;        /**< Sampling interval in milliseconds. Range is [100, 3600000] */
+    UINT capacity;           /**< Number of most recent samples kept. Range is [1, WIFI_HAL_STATS_HISTORY_MAX_SAMPLES] */
+    UINT fields_requested;   /**< Bitmask of WIFI_HAL_STATS_FIELD_* values to sample */
+} wifi_statsSamplerConfig_t;
+
+/**
+ * @brief Handle identifying a subscription to the statistics sampler, returned by #wifi_startStatsSampler()
  *
- * Starts a scan and, after the scan completes or a timeout of 4s occurs, collects scan results that match the given SSID name and frequency band.
- * 
- * @param[in] SSID               SSID name
- * @param[in] band               frequency band
- * @param[out] ap_array          Array of neighboring access points with the given SSID name and frequency band that were found by the WiFi scan. To be allocated by this function and de-allocated by the caller.
- * @param[out] output_array_size Size of ap_array
+ * A value of 0 (#WIFI_HAL_STATS_SAMPLER_HANDLE_INVALID) never identifies a subscription.
+ */
+typedef UINT wifi_statsSamplerHandle_t;
+
+#define WIFI_HAL_STATS_SAMPLER_HANDLE_INVALID 0 /**< Invalid statistics sampler handle */
+
+/**
+ * @brief Subscribes to periodic sampling of statistics into a HAL-internal history
+ *
+ * A HAL thread collects a wifi_statsSnapshot_t periodically. Each subscription has its own fixed-size ring buffer of
+ * capacity samples, overwriting the oldest sample once the buffer is full. Sampling must not block callers reading the history
+ * and callers reading the history must not delay sampling.
+ *
+ * There is one sampler thread per radio, shared by all subscriptions. It collects the union of the fields_requested
+ * of all current subscriptions at the smallest interval_ms among them. A collected snapshot is stored in the ring buffer of
+ * every subscription whose interval_ms has elapsed since the last sample it stored, so each subscription keeps capacity
+ * samples spaced by its own interval_ms and its history covers the window it requested. Adding or removing a subscription
+ * only changes the sampling from the next sample onwards and leaves the history of the other subscriptions untouched.
+ * The sampler thread is started by the first subscription and stopped by #wifi_stopStatsSampler() on the last one.
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[in] ssidIndex  The index of the SSID {Valid values: 1}
+ * @param[in] config     Sampling interval, history capacity and fields to sample requested by this subscription
+ * @param[out] handle    The handle of the subscription, to be passed to #wifi_getStatsHistory() and #wifi_stopStatsSampler()
  *
  * @return #INT - The status of the operation
  * @retval #RETURN_OK  if successful
- * @retval #RETURN_ERR if any error is detected
- * 
- * @see wifi_neighbor_ap_t, WIFI_HAL_FREQ_BAND
+ * @retval #RETURN_ERR if any error is detected or if config is out of range
+ *
  * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
- * @note This call will block until scan completes or a timeout occurs, whichever is earlier
+ * @see wifi_statsSamplerConfig_t, wifi_getStatsHistory(), wifi_stopStatsSampler(), wifi_getStatsSnapshot()
+ * @note The sampler is stopped and all subscriptions are released by wifi_uninit(). The sampler is paused by wifi_standby() until wifi_resume()
  */
-INT wifi_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+INT wifi_startStatsSampler(INT radioIndex, INT ssidIndex, const wifi_statsSamplerConfig_t *config, wifi_statsSamplerHandle_t *handle);
 
 /**
- * @brief Sets the list of frequencies to scan over
+ * @brief Unsubscribes from periodic sampling of statistics
  *
- * @param[in] radioIndex  Radio index {Valid values: 1}
- * @param[in] freqList    Space-separated frequency list. An empty list implies that a normal, full scan is performed.
- * Possible values {2412, 2417, 2422, 2427, 2432, 2437, 2442, 2447, 2452, 2457, 2462, 2467, 2472, 5160, 5180, 5200, 5220, 5240, 5260, 5280, 5300, 5320, 5340, 5480, 5500, 5520, 5540, 5560, 5580, 5600, 5620, 5640, 5660, 5680, 5700, 5720, 5745, 5765, 5785, 5805, 5825, 5845, 5865, 5885}
+ * The history of the subscription is discarded. The sampler keeps running for the remaining subscriptions.
+ * When the last subscription is removed, the sampler thread is stopped.
+ *
+ * @param[in] handle The handle returned by #wifi_startStatsSampler()
  *
  * @return #INT - The status of the operation
  * @retval #RETURN_OK  if successful
- * @retval #RETURN_ERR if any error is detected
- * 
+ * @retval #RETURN_ERR if any error is detected or if the handle is unknown
+ *
  * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_startStatsSampler()
  */
-INT wifi_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList);
+INT wifi_stopStatsSampler(wifi_statsSamplerHandle_t handle);
 
 /**
- * @brief Checks if dual band is supported
+ * @brief Gets the statistics history collected by the sampler for a subscription
+ *
+ * Copies the samples kept for the subscription, oldest first, in one call. Consecutive samples are at least the interval_ms
+ * of the subscription apart, and at most its capacity is returned. The fields requested by the subscription are present in
+ * fields_present of every returned sample when available from the driver; other fields may be present as well.
+ *
+ * @param[in] handle             The handle returned by #wifi_startStatsSampler()
+ * @param[out] samples           Array of samples. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity     Number of entries samples can hold. When smaller than the number of kept samples, the most recent samples are returned.
+ * @param[out] output_array_size Number of entries written to samples. Range is [0, array_capacity]
+ * @param[out] samples_taken     Total number of samples stored for the subscription since it started, used to detect samples overwritten between calls
  *
  * @return #INT - The status of the operation
- * @retval 1 if dual band support enabled
- * @retval 0 if dual band support disabled
- * 
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if the handle is unknown
+ *
+ * @pre wifi_startStatsSampler() should be called before calling this API
+ * @see wifi_statsSnapshot_t, wifi_startStatsSampler()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getStatsHistory(wifi_statsSamplerHandle_t handle, wifi_statsSnapshot_t *samples, UINT array_capacity, UINT *output_array_size, ULLONG *samples_taken);
+
+/**
+ * @brief Enumerators for the traffic counters of wifi_trafficDelta_t
+ */
+typedef enum {
+    WIFI_HAL_COUNTER_BYTES_SENT = 0,          /**< ssid_BytesSent */
+    WIFI_HAL_COUNTER_BYTES_RECEIVED,          /**< ssid_BytesReceived */
+    WIFI_HAL_COUNTER_PACKETS_SENT,            /**< ssid_PacketsSent */
+    WIFI_HAL_COUNTER_PACKETS_RECEIVED,        /**< ssid_PacketsReceived */
+    WIFI_HAL_COUNTER_ERRORS_SENT,             /**< ssid_ErrorsSent */
+    WIFI_HAL_COUNTER_ERRORS_RECEIVED,         /**< ssid_ErrorsReceived */
+    WIFI_HAL_COUNTER_DISCARDS_SENT,           /**< ssid_DiscardedPacketsSent */
+    WIFI_HAL_COUNTER_DISCARDS_RECEIVED,       /**< ssid_DiscardedPacketsReceived */
+    WIFI_HAL_COUNTER_RETRANSMISSIONS,         /**< ssid_RetransCount */
+    WIFI_HAL_COUNTER_RETRIES,                 /**< ssid_RetryCount */
+    WIFI_HAL_COUNTER_RADIO_BYTES_SENT,        /**< radio_BytesSent */
+    WIFI_HAL_COUNTER_RADIO_BYTES_RECEIVED,    /**< radio_BytesReceived */
+    WIFI_HAL_COUNTER_RADIO_PACKETS_SENT,      /**< radio_PacketsSent */
+    WIFI_HAL_COUNTER_RADIO_PACKETS_RECEIVED,  /**< radio_PacketsReceived */
+    WIFI_HAL_COUNTER_RADIO_ERRORS_SENT,       /**< radio_ErrorsSent */
+    WIFI_HAL_COUNTER_RADIO_ERRORS_RECEIVED,   /**< radio_ErrorsReceived */
+    WIFI_HAL_COUNTER_RADIO_DISCARDS_SENT,     /**< radio_DiscardPacketsSent */
+    WIFI_HAL_COUNTER_RADIO_DISCARDS_RECEIVED, /**< radio_DiscardPacketsReceived */
+    WIFI_HAL_COUNTER_MAX
+} wifi_trafficCounter_t;
+
+/**
+ * @brief Defines for the largest plausible increase per second of the traffic counters
+ *
+ * A decrease of a 32-bit counter whose modulo 2^32 delta exceeds these rates over the interval is treated as a reset, not a wrap.
+ */
+#define WIFI_HAL_TRAFFIC_MAX_BYTE_RATE   1250000000ULL /**< Bytes per second, 10 Gbit/s */
+#define WIFI_HAL_TRAFFIC_MAX_PACKET_RATE 1000000ULL    /**< Packets per second */
+
+/**
+ * @struct _wifi_trafficDelta
+ * @brief structure for trafficDelta
+ *
+ * Per-interval deltas and per-second rates of the traffic counters between two wifi_statsSnapshot_t.
+ */
+typedef struct _wifi_trafficDelta
+{
+    ULLONG interval_us;                     /**< Time between the two snapshots in microseconds */
+    UINT   counters_present;                /**< Bitmask of (1U << wifi_trafficCounter_t) values of the counters computed. The SSID counters need WIFI_HAL_STATS_FIELD_SSID_STATS and the radio counters need WIFI_HAL_STATS_FIELD_RADIO_STATS in both snapshots */
+    BOOL   reset;                           /**< Set if the counters were reset between the two snapshots. Each delta is then the value of the current snapshot and wrapped is 0 {0-false, 1-true} */
+    UINT   wrapped;                         /**< Bitmask of (1U << wifi_trafficCounter_t) values of the counters that wrapped around between the two snapshots. Always 0 if reset is set */
+    ULLONG delta[WIFI_HAL_COUNTER_MAX];     /**< Increase of each counter over the interval, indexed by wifi_trafficCounter_t */
+    FLOAT  rate[WIFI_HAL_COUNTER_MAX];      /**< Increase of each counter per second, indexed by wifi_trafficCounter_t */
+} wifi_trafficDelta_t;
+
+/**
+ * @brief Computes the deltas and rates of the traffic counters between two statistics snapshots
+ *
+ * A counter is 32 bits wide if its range is [0, 2^32 - 1] or if ULONG is 32 bits wide; any other counter is 64 bits wide.
+ * Reset is decided first, for the whole snapshot. The counters were reset if any of the following holds:
+ * - Both snapshots hold WIFI_HAL_STATS_FIELD_RADIO_STATS and radio_StatisticsStartTime differs.
+ * - A 64-bit wide counter decreased.
+ * - A 32-bit wide counter decreased and its modulo 2^32 delta exceeds #WIFI_HAL_TRAFFIC_MAX_BYTE_RATE or
+ *   #WIFI_HAL_TRAFFIC_MAX_PACKET_RATE over interval_us.
+ *
+ * Only if the counters were not reset, each 32-bit wide counter that decreased wrapped around once and its delta is computed modulo 2^32.
+ * A reset of the SSID counters to a value within the plausible wrap delta cannot be told apart from a wrap, unless both
+ * snapshots hold WIFI_HAL_STATS_FIELD_RADIO_STATS and the radio and SSID statistics are reset together.
+ *
+ * @param[in] previous The earlier snapshot, holding WIFI_HAL_STATS_FIELD_SSID_STATS and/or WIFI_HAL_STATS_FIELD_RADIO_STATS
+ * @param[in] current  The later snapshot, holding WIFI_HAL_STATS_FIELD_SSID_STATS and/or WIFI_HAL_STATS_FIELD_RADIO_STATS
+ * @param[out] delta   Structure which holds the deltas and rates
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected, if the snapshots have neither WIFI_HAL_STATS_FIELD_SSID_STATS nor WIFI_HAL_STATS_FIELD_RADIO_STATS in common or if current is not later than previous
+ *
+ * @see wifi_statsSnapshot_t, wifi_trafficDelta_t, wifi_getStatsSnapshot(), wifi_getStatsHistory()
+ * @note This function does not access the driver and may be called without wifi_init()
+ */
+INT wifi_computeTrafficDelta(const wifi_statsSnapshot_t *previous, const wifi_statsSnapshot_t *current, wifi_trafficDelta_t *delta);
+
+/**
+ * @brief Starts a WiFi scan and gets the scan results
+ * 
+ * Starts a scan and, after the scan completes or a timeout of 4s occurs, collects scan results.
+ * If a compatible scan is already in progress, waits for that scan instead of starting a new one.
+ *
+ * @param[in] radioIndex          The index of the radio {Valid values: 1}
+ * @param[out] neighbor_ap_array  Array of neighboring access points found by the WiFi scan. To be allocated by this function and de-allocated by the caller.
+ * @param[out] output_array_size  Size of neighbor_ap_array, maximum limit is 512.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @see wifi_neighbor_ap_t
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see @ref Data-Model Parameter: Device.WiFi.NeighboringWiFiDiagnostic., Device.WiFi.NeighboringWiFiDiagnostic.Result
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier
+ */
+INT wifi_getNeighboringWiFiDiagnosticResult(INT radioIndex, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+
+/**
+ * @brief Starts a WiFi scan and gets the scan results that match the given SSID name and frequency band
+ *
+ * Starts a scan and, after the scan completes or a timeout of 4s occurs, collects scan results that match the given SSID name and frequency band.
+ * If a compatible scan is already in progress, waits for that scan instead of starting a new one.
+ * 
+ * @param[in] SSID               SSID name
+ * @param[in] band               frequency band
+ * @param[out] ap_array          Array of neighboring access points with the given SSID name and frequency band that were found by the WiFi scan. To be allocated by this function and de-allocated by the caller.
+ * @param[out] output_array_size Size of ap_array
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ * 
+ * @see wifi_neighbor_ap_t, WIFI_HAL_FREQ_BAND
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier
+ */
+INT wifi_getSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, wifi_neighbor_ap_t **ap_array, UINT *output_array_size);
+
+/**
+ * @brief Sets the list of frequencies to scan over
+ *
+ * Applies to every subsequent scan. To restrict a single scan, use #wifi_scanParams_t instead.
+ *
+ * @param[in] radioIndex  Radio index {Valid values: 1}
+ * @param[in] freqList    Space-separated frequency list. An empty list implies that a normal, full scan is performed.
+ * Possible values {2412, 2417, 2422, 2427, 2432, 2437, 2442, 2447, 2452, 2457, 2462, 2467, 2472, 5160, 5180, 5200, 5220, 5240, 5260, 5280, 5300, 5320, 5340, 5480, 5500, 5520, 5540, 5560, 5580, 5600, 5620, 5640, 5660, 5680, 5700, 5720, 5745, 5765, 5785, 5805, 5825, 5845, 5865, 5885}
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ * 
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ */
+INT wifi_setRadioScanningFreqList(INT radioIndex, const CHAR *freqList);
+
+/**
+ * @brief Checks if dual band is supported
+ *
+ * If dual band is supported and concurrent_band_scan_supported of wifi_radioCapabilities_t is set,
+ * scans covering both bands are performed on both bands in parallel.
+ *
+ * @return #INT - The status of the operation
+ * @retval 1 if dual band support enabled
+ * @retval 0 if dual band support disabled
+ * 
  * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
  */
 INT wifi_getDualBandSupport();
@@ -1041,6 +1680,562 @@ INT wifi_getDualBandSupport();
  * @note This call will block until scan completes or a timeout occurs, whichever is earlier
  */
 INT wifi_waitForScanResults(void);
+
+/**
+ * @brief Handle identifying a scan started by #wifi_startNeighboringWiFiScan()
+ *
+ * A value of 0 (#WIFI_HAL_SCAN_HANDLE_INVALID) never identifies a scan.
+ */
+typedef UINT wifi_scanHandle_t;
+
+#define WIFI_HAL_SCAN_HANDLE_INVALID 0 /**< Invalid scan handle */
+
+/**
+ * @brief Receives the results of a scan started by #wifi_startNeighboringWiFiScan()
+ *
+ * This callback is invoked once per scan, when the scan completes, times out or is cancelled.
+ *
+ * @param[in] handle            The handle returned by #wifi_startNeighboringWiFiScan()
+ * @param[in] status            An enum variable that indicates the scan status @n
+ *                              Possible status values:
+ *                              - WIFI_HAL_SUCCESS               - Scan completed
+ *                              - WIFI_HAL_SCAN_STOPPED_EARLY    - Streaming scan was stopped by its stop filter, neighbor_ap_array holds the partial results
+ *                              - WIFI_HAL_ERROR_TIMEOUT_EXPIRED - Scan timed out after 4s, neighbor_ap_array holds the partial results
+ *                              - WIFI_HAL_ERROR_CANCELLED       - Scan was cancelled by #wifi_cancelNeighboringWiFiScan()
+ *                              - WIFI_HAL_ERROR_UNKNOWN         - Scan failed
+ * @param[in] neighbor_ap_array Array of neighboring access points found by the WiFi scan. Owned by the HAL and only valid for the duration of the callback.
+ * @param[in] array_size        Size of neighbor_ap_array, maximum limit is 512.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_scanComplete_callback_register() should be called before calling this API
+ * @see wifi_neighbor_ap_t, wifiStatusCode_t, wifi_startNeighboringWiFiScan()
+ */
+typedef INT (*wifi_scanComplete_callback)(wifi_scanHandle_t handle, wifiStatusCode_t status, wifi_neighbor_ap_t *neighbor_ap_array, UINT array_size);
+
+/**
+ * @brief Registers for scan complete callback
+ *
+ * @param[in] callback_proc The callback function to receive scan results
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_startNeighboringWiFiScan()
+ */
+void wifi_scanComplete_callback_register(wifi_scanComplete_callback callback_proc);
+
+/**
+ * @brief Starts a WiFi scan without waiting for the scan results
+ *
+ * Returns as soon as the scan request has been issued to the driver. The results are delivered
+ * through wifi_scanComplete_callback() once the scan completes or a timeout of 4s occurs.
+ * If a compatible scan is already in progress, no new scan is started: the request attaches to the scan in progress
+ * and receives the same results. A scan in progress is compatible when it covers every requested frequency and band
+ * with the same scan mode and dwell time, probes for every requested directed SSID and has no stop filter.
+ * Every request gets its own handle, also when it is attached to a scan started by another caller.
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[out] handle    The handle of the started scan, reported back in wifi_scanComplete_callback()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @pre wifi_scanComplete_callback_register() should be called before calling this API
+ * @see wifi_scanComplete_callback(), wifi_cancelNeighboringWiFiScan(), wifi_getNeighboringWiFiDiagnosticResult()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_startNeighboringWiFiScan(INT radioIndex, wifi_scanHandle_t *handle);
+
+/**
+ * @brief Cancels a scan started by #wifi_startNeighboringWiFiScan()
+ *
+ * wifi_scanComplete_callback() is invoked with WIFI_HAL_ERROR_CANCELLED for the given handle only.
+ * If other requests are attached to the same scan, the scan carries on for them; the scan is only aborted
+ * once every attached request has been cancelled. Cancelling a scan that has already completed has no effect.
+ *
+ * @param[in] handle The handle returned by #wifi_startNeighboringWiFiScan()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful or if the scan has already completed
+ * @retval #RETURN_ERR if any error is detected or if the handle is unknown
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_startNeighboringWiFiScan()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_cancelNeighboringWiFiScan(wifi_scanHandle_t handle);
+
+/**
+ * @brief Receives a single access point found by a scan started by #wifi_startStreamingScan()
+ *
+ * This callback is invoked as soon as the driver reports an access point, at most once per BSSID and scan.
+ *
+ * @param[in] handle The handle returned by #wifi_startStreamingScan()
+ * @param[in] ap     The neighboring access point. Owned by the HAL and only valid for the duration of the callback.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_scanResult_callback_register() should be called before calling this API
+ * @see wifi_neighbor_ap_t, wifi_startStreamingScan()
+ */
+typedef INT (*wifi_scanResult_callback)(wifi_scanHandle_t handle, wifi_neighbor_ap_t *ap);
+
+/**
+ * @brief Registers for scan result callback
+ *
+ * @param[in] callback_proc The callback function to receive access points as they are found
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_startStreamingScan()
+ */
+void wifi_scanResult_callback_register(wifi_scanResult_callback callback_proc);
+
+/**
+ * @struct _wifi_scanStopFilter
+ * @brief structure for scanStopFilter
+ *
+ * An access point matches when it matches every field that is set.
+ */
+typedef struct _wifi_scanStopFilter
+{
+    CHAR               ssid[64];   /**< SSID to match. Empty string matches any SSID */
+    CHAR               bssid[64];  /**< BSSID to match, in "AA:BB:CC:DD:EE:FF" format. Empty string matches any BSSID */
+    WIFI_HAL_FREQ_BAND band;       /**< Frequency band to match. WIFI_HAL_FREQ_BAND_NONE matches any band */
+} wifi_scanStopFilter_t;
+
+/**
+ * @brief Starts a WiFi scan that reports each access point as soon as it is found
+ *
+ * Behaves as #wifi_startNeighboringWiFiScan(), and additionally invokes wifi_scanResult_callback() for each access point
+ * as the driver reports it. If stopFilter is given, the scan is stopped as soon as an access point matching it is found.
+ * wifi_scanComplete_callback() is invoked with WIFI_HAL_SUCCESS once the scan completes, or with WIFI_HAL_SCAN_STOPPED_EARLY and
+ * the access points found so far once the stop filter is matched. The results of a stopped scan are partial: they are merged into
+ * the scan result cache without removing any cached entry, and do not refresh the age of the cache, see #wifi_scanCacheInfo_t.
+ * A scan with a stop filter never attaches to a scan in progress, and no other request attaches to it.
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[in] stopFilter  Access point that ends the scan early when found, {Ex: the SSID and band passed to wifi_getSpecificSSIDInfo()}. NULL runs a full scan.
+ * @param[out] handle     The handle of the started scan, reported back in wifi_scanResult_callback() and wifi_scanComplete_callback()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @pre wifi_scanResult_callback_register() and wifi_scanComplete_callback_register() should be called before calling this API
+ * @see wifi_scanStopFilter_t, wifi_scanResult_callback(), wifi_scanComplete_callback(), wifi_cancelNeighboringWiFiScan()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_startStreamingScan(INT radioIndex, const wifi_scanStopFilter_t *stopFilter, wifi_scanHandle_t *handle);
+
+/**
+ * @brief Defines for the limits of wifi_scanParams_t
+ */
+#define WIFI_HAL_SCAN_MAX_FREQUENCIES    64   /**< Maximum number of frequencies in a scan */
+#define WIFI_HAL_SCAN_MAX_SSIDS          8    /**< Maximum number of directed SSIDs in a scan */
+#define WIFI_HAL_SCAN_MAX_TOTAL_DWELL_MS 3000 /**< Maximum of dwell_time_ms multiplied by the number of channels scanned, so that a scan completes within the 4s scan timeout */
+
+/**
+ * @brief Enumerators for WiFi scan modes
+ */
+typedef enum {
+    WIFI_HAL_SCAN_MODE_ACTIVE = 0,   /**< Send probe requests on each channel */
+    WIFI_HAL_SCAN_MODE_PASSIVE       /**< Only listen for beacons on each channel */
+} wifi_scanMode_t;
+
+/**
+ * @struct _wifi_scanParams
+ * @brief structure for scanParams
+ *
+ * Parameters of a single scan. They do not change the frequency list set by wifi_setRadioScanningFreqList().
+ * The number of channels scanned is num_frequencies or, if it is 0, the number of frequencies of the list set by
+ * wifi_setRadioScanningFreqList() in the selected bands. Every scan keeps the 4s scan timeout, so parameters whose
+ * total dwell time exceeds #WIFI_HAL_SCAN_MAX_TOTAL_DWELL_MS are out of range.
+ */
+typedef struct _wifi_scanParams
+{
+    UINT            frequencies[WIFI_HAL_SCAN_MAX_FREQUENCIES];  /**< Frequencies to scan in MHz. Possible values are those of wifi_setRadioScanningFreqList() */
+    UINT            num_frequencies;                             /**< Number of valid entries in frequencies. 0 scans the frequency list set by wifi_setRadioScanningFreqList() */
+    UINT            dwell_time_ms;                               /**< Time spent on each channel in milliseconds. 0 uses the driver default. Range is [0, 1000], and dwell_time_ms multiplied by the number of channels scanned must not exceed WIFI_HAL_SCAN_MAX_TOTAL_DWELL_MS */
+    wifi_scanMode_t mode;                                        /**< Active or passive scan */
+    CHAR            ssids[WIFI_HAL_SCAN_MAX_SSIDS][64];          /**< SSIDs to send directed probe requests for, {Ex: hidden networks}. Only used by active scans */
+    UINT            num_ssids;                                   /**< Number of valid entries in ssids. 0 sends broadcast probe requests only */
+    UINT            bands;                                       /**< Bitmask of WIFI_HAL_FREQ_BAND_FLAG() values of the bands to scan. 0 scans every supported band */
+    UINT            max_results;                                 /**< Maximum number of access points returned, strongest first. 0 uses the maximum limit of 512 */
+} wifi_scanParams_t;
+
+/**
+ * @brief Starts a WiFi scan with the given parameters and gets the scan results
+ *
+ * Behaves as #wifi_getNeighboringWiFiDiagnosticResult() but scans according to params.
+ * The scan results are merged into the cache only for the scanned frequencies, see #wifi_scanCacheInfo_t.
+ *
+ * @param[in] radioIndex          The index of the radio {Valid values: 1}
+ * @param[in] params              Parameters of the scan. NULL behaves as #wifi_getNeighboringWiFiDiagnosticResult().
+ * @param[out] neighbor_ap_array  Array of neighboring access points found by the WiFi scan. To be allocated by this function and de-allocated by the caller.
+ * @param[out] output_array_size  Size of neighbor_ap_array, maximum limit is 512 or params->max_results if it is not 0.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if params is out of range
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_scanParams_t, wifi_neighbor_ap_t, wifi_getNeighboringWiFiDiagnosticResult()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier
+ */
+INT wifi_getNeighboringWiFiDiagnosticResultWithParams(INT radioIndex, const wifi_scanParams_t *params, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size);
+
+/**
+ * @brief Starts a WiFi scan with the given parameters without waiting for the scan results
+ *
+ * Behaves as #wifi_startNeighboringWiFiScan() but scans according to params. A scan in progress is only shared
+ * if it covers all the requested frequencies and bands with the same mode and dwell time, probes for all the requested
+ * directed SSIDs and has no stop filter.
+ *
+ * @param[in] radioIndex The index of the radio {Valid values: 1}
+ * @param[in] params     Parameters of the scan. NULL behaves as #wifi_startNeighboringWiFiScan().
+ * @param[out] handle    The handle of the started scan, reported back in wifi_scanComplete_callback()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if params is out of range
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @pre wifi_scanComplete_callback_register() should be called before calling this API
+ * @see wifi_scanParams_t, wifi_startNeighboringWiFiScan(), wifi_scanComplete_callback()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_startNeighboringWiFiScanWithParams(INT radioIndex, const wifi_scanParams_t *params, wifi_scanHandle_t *handle);
+
+/**
+ * @brief Starts a WiFi scan with the given parameters that reports each access point as soon as it is found
+ *
+ * Behaves as #wifi_startStreamingScan() but scans according to params. With a stopFilter, the scan is never shared;
+ * without one, a scan in progress is shared as described in #wifi_startNeighboringWiFiScanWithParams().
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[in] params      Parameters of the scan. NULL behaves as #wifi_startStreamingScan().
+ * @param[in] stopFilter  Access point that ends the scan early when found. NULL runs the scan described by params to completion.
+ * @param[out] handle     The handle of the started scan, reported back in wifi_scanResult_callback() and wifi_scanComplete_callback()
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if params is out of range
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @pre wifi_scanResult_callback_register() and wifi_scanComplete_callback_register() should be called before calling this API
+ * @see wifi_scanParams_t, wifi_scanStopFilter_t, wifi_startStreamingScan(), wifi_cancelNeighboringWiFiScan()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_startStreamingScanWithParams(INT radioIndex, const wifi_scanParams_t *params, const wifi_scanStopFilter_t *stopFilter, wifi_scanHandle_t *handle);
+
+/**
+ * @struct _wifi_scanCacheInfo
+ * @brief Structure for the state of the HAL scan result cache
+ *
+ * Every scan, whether started by a blocking or a non-blocking API, is merged into the cached scan results, channel by channel.
+ * A scan which completes normally replaces the cached entries on the channels it scanned: entries on those channels which
+ * were not seen again are removed. A scan which ends early only adds or updates the entries it has seen and removes none.
+ * Entries on channels which were not scanned are kept unchanged.
+ *
+ * The HAL keeps the time each channel was last fully scanned. The cached scan results are only as recent as the least
+ * recently scanned channel a query covers, so entries kept from older scans never pass a maxAge_ms check on their own.
+ */
+typedef struct _wifi_scanCacheInfo
+{
+    UINT   epoch;          /**< Identifier of the cache instance, chosen anew by every wifi_init() or wifi_initWithConfig() and different from the epochs of the previous initializations since boot. Generations are only comparable within the same epoch. Range is [1, 2^32 - 1] */
+    UINT   generation;     /**< Generation number of the cached scan results. Incremented by one on every scan merged into the cache. 0 if no scan has completed since wifi_init(). Range is [0, 2^32 - 1] */
+    ULLONG timestamp_ms;   /**< Time of the last merge into the cache, in milliseconds of CLOCK_MONOTONIC. Range is [0, 2^64 - 1] */
+    ULLONG refresh_timestamp_ms; /**< Time at which the least recently scanned channel was last fully scanned, in milliseconds of CLOCK_MONOTONIC. 0 if a supported channel has never been fully scanned. Range is [0, 2^64 - 1] */
+    ULLONG age_ms;         /**< Age of the cached scan results at the time of the query, measured from refresh_timestamp_ms, in milliseconds. Range is [0, 2^64 - 1] */
+    UINT   ap_count;       /**< Number of access points in the cached scan results, maximum limit is 512 */
+} wifi_scanCacheInfo_t;
+
+/**
+ * @brief Gets the state of the HAL scan result cache
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[out] cacheInfo  Structure which holds the state of the scan result cache
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_scanCacheInfo_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getScanCacheInfo(INT radioIndex, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Gets the scan results, using the cached scan results if they are recent enough
+ *
+ * If every supported channel was fully scanned not longer than maxAge_ms ago, the cached scan results are returned without starting a scan.
+ * Otherwise, behaves as #wifi_getNeighboringWiFiDiagnosticResult(). A maxAge_ms of 0 always starts a scan.
+ *
+ * @param[in] radioIndex          The index of the radio {Valid values: 1}
+ * @param[in] maxAge_ms           Maximum acceptable age of the cached scan results, in milliseconds
+ * @param[out] neighbor_ap_array  Array of neighboring access points. To be allocated by this function and de-allocated by the caller.
+ * @param[out] output_array_size  Size of neighbor_ap_array, maximum limit is 512.
+ * @param[out] cacheInfo          Generation and timestamp of the returned scan results. May be NULL.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t, wifi_scanCacheInfo_t, wifi_getNeighboringWiFiDiagnosticResult()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getCachedNeighboringWiFiDiagnosticResult(INT radioIndex, UINT maxAge_ms, wifi_neighbor_ap_t **neighbor_ap_array, UINT *output_array_size, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Gets the scan results that match the given SSID name and frequency band, using the cached scan results if they are recent enough
+ *
+ * If every channel of the given band was fully scanned not longer than maxAge_ms ago, the matching entries are returned without starting a scan.
+ * Otherwise, behaves as #wifi_getSpecificSSIDInfo(). A maxAge_ms of 0 always starts a scan.
+ *
+ * @param[in] SSID               SSID name
+ * @param[in] band               frequency band
+ * @param[in] maxAge_ms          Maximum acceptable age of the cached scan results, in milliseconds
+ * @param[out] ap_array          Array of neighboring access points with the given SSID name and frequency band. To be allocated by this function and de-allocated by the caller.
+ * @param[out] output_array_size Size of ap_array
+ * @param[out] cacheInfo         Generation and timestamp of the scan results the entries were taken from. May be NULL.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t, WIFI_HAL_FREQ_BAND, wifi_scanCacheInfo_t, wifi_getSpecificSSIDInfo()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getCachedSpecificSSIDInfo(const char *SSID, WIFI_HAL_FREQ_BAND band, UINT maxAge_ms, wifi_neighbor_ap_t **ap_array, UINT *output_array_size, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Gets the cached scan result of the access point with the given BSSID
+ *
+ * Looked up in the BSSID index of the scan result cache, without starting a scan.
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[in] BSSID       BSSID of the access point, in "AA:BB:CC:DD:EE:FF" format. Case insensitive.
+ * @param[out] ap         Structure which holds the cached scan result
+ * @param[out] cacheInfo  Generation and timestamp of the scan results the entry was taken from. May be NULL.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if the BSSID is not in the cached scan results
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t, wifi_scanCacheInfo_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getCachedBSSIDInfo(INT radioIndex, const CHAR *BSSID, wifi_neighbor_ap_t *ap, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Gets the cached scan results of the access points on the given channel into a caller-provided array
+ *
+ * Looked up in the channel index of the scan result cache, without starting a scan.
+ * Entries are ordered by decreasing ap_SignalStrength.
+ *
+ * @param[in] radioIndex         The index of the radio {Valid values: 1}
+ * @param[in] channel            Channel number. Possible values {1-13, 36-64,100-165}
+ * @param[out] ap_array          Array of neighboring access points on the channel. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity     Number of entries ap_array can hold
+ * @param[out] output_array_size Number of entries written to ap_array. Range is [0, array_capacity]
+ * @param[out] truncated_count   Number of entries left out because ap_array was too small
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful, including when no access point is on the channel
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getCachedChannelInfo(INT radioIndex, UINT channel, wifi_neighbor_ap_t *ap_array, UINT array_capacity, UINT *output_array_size, UINT *truncated_count);
+
+/**
+ * @brief Gets the scan results in compact form, using the cached scan results if they are recent enough
+ *
+ * Behaves as #wifi_getCachedNeighboringWiFiDiagnosticResult() but returns the scan results as a wifi_compactScanResult_t.
+ *
+ * @param[in] radioIndex  The index of the radio {Valid values: 1}
+ * @param[in] maxAge_ms   Maximum acceptable age of the cached scan results, in milliseconds. 0 always starts a scan.
+ * @param[out] result     Compact scan results. To be allocated by this function as a single block and de-allocated by the caller with a single free().
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_compactScanResult_t, wifi_compact_neighbor_ap_t, wifi_compactNeighborApToLegacy()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getCompactScanResult(INT radioIndex, UINT maxAge_ms, wifi_compactScanResult_t **result);
+
+/**
+ * @brief Converts an entry of compact scan results to wifi_neighbor_ap_t
+ *
+ * ap_ChannelUtilization[0] of the legacy structure holds the converted utilization, the remaining elements are set to 0.
+ *
+ * @param[in] result       Compact scan results returned by #wifi_getCompactScanResult()
+ * @param[in] index        Index of the entry in result->ap_array. Range is [0, result->ap_count - 1]
+ * @param[out] neighbor_ap Structure which holds the converted entry
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected or if index is out of range
+ *
+ * @see wifi_compactScanResult_t, wifi_neighbor_ap_t
+ * @note This function does not access the driver and may be called without wifi_init()
+ */
+INT wifi_compactNeighborApToLegacy(const wifi_compactScanResult_t *result, UINT index, wifi_neighbor_ap_t *neighbor_ap);
+
+/**
+ * @brief Gets the scan results into a caller-provided array, using the cached scan results if they are recent enough
+ *
+ * Behaves as #wifi_getCachedNeighboringWiFiDiagnosticResult() but does not allocate memory. Entries are ordered by
+ * decreasing ap_SignalStrength, so that when the array is too small the weakest access points are left out.
+ *
+ * @param[in] radioIndex          The index of the radio {Valid values: 1}
+ * @param[in] maxAge_ms           Maximum acceptable age of the cached scan results, in milliseconds. 0 always starts a scan.
+ * @param[out] neighbor_ap_array  Array of neighboring access points. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity      Number of entries neighbor_ap_array can hold
+ * @param[out] output_array_size  Number of entries written to neighbor_ap_array. Range is [0, array_capacity]
+ * @param[out] truncated_count    Number of entries left out because neighbor_ap_array was too small
+ * @param[out] cacheInfo          Generation and timestamp of the returned scan results. May be NULL.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful, including when entries were left out
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t, wifi_getCachedNeighboringWiFiDiagnosticResult()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getNeighboringWiFiDiagnosticResultToBuffer(INT radioIndex, UINT maxAge_ms, wifi_neighbor_ap_t *neighbor_ap_array, UINT array_capacity, UINT *output_array_size, UINT *truncated_count, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Gets the scan results that match the given SSID name and frequency band into a caller-provided array
+ *
+ * Behaves as #wifi_getCachedSpecificSSIDInfo() but does not allocate memory. Entries are ordered by
+ * decreasing ap_SignalStrength, so that when the array is too small the weakest access points are left out.
+ *
+ * @param[in] SSID               SSID name
+ * @param[in] band               frequency band
+ * @param[in] maxAge_ms          Maximum acceptable age of the cached scan results, in milliseconds. 0 always starts a scan.
+ * @param[out] ap_array          Array of neighboring access points with the given SSID name and frequency band. To be allocated and de-allocated by the caller.
+ * @param[in] array_capacity     Number of entries ap_array can hold
+ * @param[out] output_array_size Number of entries written to ap_array. Range is [0, array_capacity]
+ * @param[out] truncated_count   Number of entries left out because ap_array was too small
+ * @param[out] cacheInfo         Generation and timestamp of the scan results the entries were taken from. May be NULL.
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful, including when entries were left out
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_neighbor_ap_t, WIFI_HAL_FREQ_BAND, wifi_scanCacheInfo_t, wifi_getCachedSpecificSSIDInfo()
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getSpecificSSIDInfoToBuffer(const char *SSID, WIFI_HAL_FREQ_BAND band, UINT maxAge_ms, wifi_neighbor_ap_t *ap_array, UINT array_capacity, UINT *output_array_size, UINT *truncated_count, wifi_scanCacheInfo_t *cacheInfo);
+
+/**
+ * @brief Defines the buffer size that holds compact scan results with the given number of access points
+ *
+ * Covers the worst case in which every access point has a distinct SSID of 32 characters.
+ */
+#define WIFI_HAL_COMPACT_SCAN_RESULT_SIZE(ap_count) \
+    (sizeof(wifi_compactScanResult_t) + (ap_count) * (sizeof(wifi_compact_neighbor_ap_t) + 33))
+
+/**
+ * @brief Gets the scan results in compact form into a caller-provided buffer
+ *
+ * Behaves as #wifi_getCompactScanResult() but lays out the results in buffer instead of allocating memory.
+ * The buffer can be reused across calls as a result pool. Entries are ordered by decreasing ap_SignalStrength,
+ * so that when the buffer is too small the weakest access points are left out.
+ *
+ * @param[in] radioIndex       The index of the radio {Valid values: 1}
+ * @param[in] maxAge_ms        Maximum acceptable age of the cached scan results, in milliseconds. 0 always starts a scan.
+ * @param[out] buffer          Buffer which holds the compact scan results. To be allocated and de-allocated by the caller, aligned as returned by malloc().
+ * @param[in] buffer_size      Size of buffer in bytes. #WIFI_HAL_COMPACT_SCAN_RESULT_SIZE(512) is always sufficient.
+ * @param[out] result          Points to the compact scan results inside buffer
+ * @param[out] truncated_count Number of entries left out because buffer was too small
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful, including when entries were left out
+ * @retval #RETURN_ERR if any error is detected or if buffer_size is smaller than sizeof(wifi_compactScanResult_t)
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_compactScanResult_t, WIFI_HAL_COMPACT_SCAN_RESULT_SIZE
+ * @note This call will block until scan completes or a timeout occurs, whichever is earlier, if the cached scan results are too old
+ */
+INT wifi_getCompactScanResultToBuffer(INT radioIndex, UINT maxAge_ms, void *buffer, UINT buffer_size, wifi_compactScanResult_t **result, UINT *truncated_count);
+
+/**
+ * @brief Enumerators for the kind of change reported in wifi_scanDelta_t
+ */
+typedef enum {
+    WIFI_HAL_SCAN_DELTA_ADDED = 0,   /**< The BSSID was not present in the scan results of since_generation */
+    WIFI_HAL_SCAN_DELTA_REMOVED,     /**< The BSSID is no longer present in the scan results */
+    WIFI_HAL_SCAN_DELTA_CHANGED      /**< The BSSID is still present and changed materially, see change_flags */
+} wifi_scanDeltaType_t;
+
+/**
+ * @brief Defines for the material changes reported in wifi_scanDelta_t
+ */
+#define WIFI_HAL_SCAN_CHANGE_RSSI_LEVEL  (1U << 0) /**< ap_SignalStrength moved to another wifiRSSILevel_t level */
+#define WIFI_HAL_SCAN_CHANGE_CHANNEL     (1U << 1) /**< ap_Channel or ap_OperatingFrequencyBand changed */
+#define WIFI_HAL_SCAN_CHANGE_SECURITY    (1U << 2) /**< ap_SecurityModeEnabled or ap_EncryptionMode changed */
+#define WIFI_HAL_SCAN_CHANGE_SSID        (1U << 3) /**< ap_SSID changed */
+
+/**
+ * @struct _wifi_scanDelta
+ * @brief structure for scanDelta
+ */
+typedef struct _wifi_scanDelta
+{
+    wifi_scanDeltaType_t type;           /**< The kind of change */
+    UINT                 change_flags;   /**< Bitmask of WIFI_HAL_SCAN_CHANGE_* values. 0 unless type is WIFI_HAL_SCAN_DELTA_CHANGED */
+    wifi_neighbor_ap_t   ap;             /**< The current entry, or the last known entry if type is WIFI_HAL_SCAN_DELTA_REMOVED */
+} wifi_scanDelta_t;
+
+/**
+ * @brief Gets the changes in the cached scan results since the given generation
+ *
+ * Only access points that were added, removed or materially changed are reported. Changes of RSSI within the same
+ * wifiRSSILevel_t level and of other fields of wifi_neighbor_ap_t are not reported. This function does not start a scan.
+ * An access point is only reported as WIFI_HAL_SCAN_DELTA_REMOVED when a scan which completed normally covered its channel
+ * without seeing it, as described in #wifi_scanCacheInfo_t.
+ *
+ * If since_epoch is not the current epoch of the cache, since_generation is 0, or the HAL no longer holds the history needed
+ * to compute the changes since since_generation, every access point in the cached scan results is reported as
+ * WIFI_HAL_SCAN_DELTA_ADDED and full_resync is set. A generation held from before wifi_uninit() is therefore never
+ * mistaken for the same generation number of the current cache.
+ *
+ * @param[in] radioIndex         The index of the radio {Valid values: 1}
+ * @param[in] since_epoch        Epoch of the scan results the caller currently holds, as reported in wifi_scanCacheInfo_t. 0 if the caller holds none.
+ * @param[in] since_generation   Generation of the scan results the caller currently holds, as reported in wifi_scanCacheInfo_t
+ * @param[out] delta_array       Array of changes. To be allocated by this function and de-allocated by the caller. NULL if there are no changes.
+ * @param[out] delta_array_size  Size of delta_array, maximum limit is 1024.
+ * @param[out] cacheInfo         Epoch and generation of the scan results the changes lead to. To be passed as since_epoch and since_generation in the next call.
+ * @param[out] full_resync       Set to 1 if the caller must discard its scan results and rebuild them from delta_array {0-false, 1-true}
+ *
+ * @return #INT - The status of the operation
+ * @retval #RETURN_OK  if successful
+ * @retval #RETURN_ERR if any error is detected
+ *
+ * @pre wifi_init() or wifi_initWithConfig() should be called before calling this API
+ * @see wifi_scanDelta_t, wifi_scanCacheInfo_t, wifiRSSILevel_t, wifi_getCachedNeighboringWiFiDiagnosticResult()
+ * @note This function must not invoke any blocking calls.
+ */
+INT wifi_getNeighboringWiFiDiagnosticDelta(INT radioIndex, UINT since_epoch, UINT since_generation, wifi_scanDelta_t **delta_array, UINT *delta_array_size, wifi_scanCacheInfo_t *cacheInfo, BOOL *full_resync);
 /** @} */ // End of WIFI_COMMON_HAL
 /** @} */ // End of RDKV_WIFI_HAL
 /** @} */ // End of RDKV_WIFI